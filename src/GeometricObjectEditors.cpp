@@ -1,4 +1,7 @@
 #include "GeometricObjectEditors.hpp"
+#include <algorithm>
+#include <chrono>
+#include <unordered_map>
 
 uint8_t Editor::ObjectEditor::edit_sphere(RT::GeometricObjectPtr& object)
 {
@@ -523,16 +526,112 @@ uint8_t Editor::ObjectEditor::edit_instance(RT::GeometricObjectPtr& object)
     return state;
 }
 
-uint8_t Editor::ObjectEditor::edit_bvh(RT::GeometricObjectPtr& object)
+/// @brief Nesting statistics of the scene hierarchy below a BVH. The tree
+/// built internally by the BVH is not exposed, so it isn't measured
+struct BVHStats {
+    uint32_t primitive_count = 0;
+    uint32_t container_count = 0;
+    uint32_t max_depth = 0;
+    uint64_t depth_sum = 0;
+    uint64_t child_count = 0;
+    double build_time = 0.0;
+};
+
+/// @brief Cached stats. The weak reference detects destroyed objects whose
+/// address is reused, and the revision detects modified hierarchies
+struct BVHStatsEntry {
+    std::weak_ptr<RT::GeometricObject> object;
+    uint32_t revision = 0;
+    BVHStats stats;
+};
+
+static void collect_bvh_stats(const RT::GeometricObjectPtr& object, uint32_t depth, BVHStats& stats)
+{
+    if (!is_container_type(object->get_type())) {
+        stats.primitive_count++;
+        stats.depth_sum += depth;
+        stats.max_depth = std::max(stats.max_depth, depth);
+        return;
+    }
+
+    stats.container_count++;
+    auto container = std::dynamic_pointer_cast<GeometricObjects::Container>(object);
+    stats.child_count += container->size();
+
+    for (int i = 0; i < container->size(); i++)
+        collect_bvh_stats(*(i + container->begin()), depth + 1, stats);
+}
+
+uint8_t Editor::ObjectEditor::edit_bvh(RT::GeometricObjectPtr& object, SceneNodePtr& scene_node)
 {
     uint8_t state = EditState::None;
     auto bvh = std::dynamic_pointer_cast<GeometricObjects::BVH>(object);
 
+    // Stats are cached, walking huge hierarchies every frame is expensive
+    static std::unordered_map<const GeometricObject*, BVHStatsEntry> s_stats;
+
+    // Drops entries of destroyed objects
+    for (auto itr = s_stats.begin(); itr != s_stats.end();) {
+        if (itr->second.object.expired())
+            itr = s_stats.erase(itr);
+        else
+            itr++;
+    }
+
+    auto itr = s_stats.find(bvh.get());
+    bool cached = itr != s_stats.end() && itr->second.object.lock() == object;
+    bool outdated = !cached || itr->second.revision != scene_node->get_revision();
+
+    bool rebuild = ImGui::Button("Rebuild");
+    if (rebuild || outdated) {
+        BVHStats stats;
+
+        // Build time is only measured by 'Rebuild', it's kept while the
+        // hierarchy is modified
+        if (cached)
+            stats.build_time = itr->second.stats.build_time;
+
+        if (rebuild) {
+            // Pending child modifications are rebuilt first, so only the
+            // BVH itself is timed
+            SceneNode::rebuild_modified(scene_node);
+
+            auto start = std::chrono::high_resolution_clock::now();
+            bvh->recalculate_bounding_box();
+            auto end = std::chrono::high_resolution_clock::now();
+            stats.build_time = std::chrono::duration<double>(end - start).count();
+
+            // Ancestors must be refitted to the rebuilt BVH
+            SceneNodePtr parent = scene_node->get_parent();
+            SceneNode::bounding_box_modified(parent);
+        }
+        collect_bvh_stats(bvh, 0, stats);
+        itr = s_stats.insert_or_assign(bvh.get(), BVHStatsEntry { object, scene_node->get_revision(), stats }).first;
+    }
+
     if (bvh->is_built())
         ImGui::Text("Tree built");
     else
         ImGui::Text("Tree not built");
 
+    const BVHStats& stats = itr->second.stats;
+    uint32_t leaf_count = std::max(stats.primitive_count, 1u);
+
+    // The tree built inside the BVH isn't exposed by the library, so these
+    // describe the shape of the scene hierarchy below it, not BVH quality
+    ImGui::Text("Scene hierarchy below the BVH:");
+    ImGui::Text("Primitives: %u", stats.primitive_count);
+    ImGui::Text("Nested containers: %u", stats.container_count - 1);
+    ImGui::Text("Max nesting depth: %u", stats.max_depth);
+    ImGui::Text("Average nesting depth: %.2f", static_cast<double>(stats.depth_sum) / leaf_count);
+    ImGui::Text("Average children per container: %.2f",
+        static_cast<double>(stats.child_count) / std::max(stats.container_count, 1u));
+
+    if (stats.build_time > 0.0)
+        ImGui::Text("Build time: %.4f s", stats.build_time);
+    else
+        ImGui::Text("Build time: rebuild to measure");
+
     return state;
 }
 
@@ -2,6 +2,7 @@
 #define __GEOMETRIC_OBJECT_EDITORS__
 
 #include "ImGuiRT.hpp"
+#include "editor/SceneNode.hpp"
 #include <CPU-Ray-Tracing/CPURayTracer.hpp>
 
 namespace Editor {
@@ -51,7 +52,7 @@ namespace ObjectEditor {
 
     uint8_t edit_instance(RT::GeometricObjectPtr& object);
 
-    uint8_t edit_bvh(RT::GeometricObjectPtr& object);
+    uint8_t edit_bvh(RT::GeometricObjectPtr& object, SceneNodePtr& scene_node);
 
     uint8_t edit_container(RT::GeometricObjectPtr& object);
 
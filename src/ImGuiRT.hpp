@@ -1,6 +1,7 @@
 #ifndef __IMGUI_RT_UTILS__
 #define __IMGUI_RT_UTILS__
 #include "ImGuiUtils.hpp"
+#include "SamplerCache.hpp"
 #include <memory>
 
 #include "CPU-Ray-Tracing/CPURayTracer.hpp"
@@ -408,39 +409,13 @@ static bool edit_sampler(const char* label, std::shared_ptr<Sampler>& sampler)
     int samples = sampler->get_num_samples();
     modified |= ImGui::InputInt("Samples", &samples);
 
-    // If either, samples or sampler type were modified, creates a new sampler
+    // If either, samples or sampler type were modified, sets a copy of the cached
+    // sampler. Keeps the Disk or Hemisphere mode of the previous sampler
     if (modified) {
-        std::shared_ptr<Sampler> new_sampler;
-        switch (static_cast<SamplerType>(modified_index)) {
-        case SamplerType::Regular:
-            new_sampler = std::make_shared<Samplers::RegularSampler>(samples);
-            break;
-
-        case SamplerType::Jittered:
-            new_sampler = std::make_shared<Samplers::JitteredSampler>(samples);
-            break;
-
-        case SamplerType::MultiJittered:
-            new_sampler = std::make_shared<Samplers::MultiJitteredSampler>(samples);
-            break;
-
-        case SamplerType::NRooks:
-            new_sampler = std::make_shared<Samplers::NRooksSampler>(samples);
-        }
-
-        new_sampler->generate_samples();
-        new_sampler->setup_shuffled_indices();
-
-        // If previous sampler used Disk or Hemisphere mode,
-        // copies the mode by calling the mapping methods
-        if (sampler->get_mode() == SampleMode::Disk)
-            new_sampler->map_samples_to_unit_disk();
-
-        else if (sampler->get_mode() == SampleMode::Hemisphere)
-            new_sampler->map_samples_to_hemisphere(1);
-
-        // Sets the new sampler
-        sampler = new_sampler;
+        sampler = SamplerCache::get(
+            static_cast<SamplerType>(modified_index),
+            samples,
+            sampler->get_mode());
     }
     ImGui::TreePop();
     return modified;
@@ -0,0 +1,52 @@
+#include "ImageConversion.hpp"
+#include <algorithm>
+#include <future>
+#include <thread>
+#include <vector>
+
+using namespace RT;
+
+// Below this amount of pixels per task, starting a thread costs more than
+// the work it does
+static constexpr size_t s_min_pixels_per_task = 64 * 1024;
+
+void ImageConversion::parallel_rows(uint32_t width, uint32_t height, const std::function<void(uint32_t, uint32_t)>& fn)
+{
+    size_t pixel_count = static_cast<size_t>(width) * height;
+    size_t max_tasks = std::max<size_t>(1, pixel_count / s_min_pixels_per_task);
+    uint32_t thread_count = static_cast<uint32_t>(std::min<size_t>(std::max(1u, std::thread::hardware_concurrency()), max_tasks));
+
+    if (thread_count == 1) {
+        fn(0, height);
+        return;
+    }
+
+    uint32_t rows_per_thread = (height + thread_count - 1) / thread_count;
+
+    // The calling thread processes the first range
+    std::vector<std::future<void>> tasks;
+    for (uint32_t row = rows_per_thread; row < height; row += rows_per_thread) {
+        uint32_t row_end = std::min(height, row + rows_per_thread);
+        tasks.push_back(std::async(std::launch::async, fn, row, row_end));
+    }
+    fn(0, std::min(height, rows_per_thread));
+
+    for (auto& task : tasks)
+        task.get();
+}
+
+void ImageConversion::to_rgba8(const RGBColor* pixels, uint32_t width, uint32_t height, Wolf::RGBA8_UI* rgba)
+{
+    // Row major conversion, contiguous in both buffers
+    parallel_rows(width, height, [&](uint32_t row_begin, uint32_t row_end) {
+        size_t end = static_cast<size_t>(row_end) * width;
+        for (size_t i = static_cast<size_t>(row_begin) * width; i < end; i++) {
+            RGBColor color = glm::clamp(pixels[i], RGBColor(0), RGBColor(1)) * 255.0f;
+            rgba[i] = Wolf::RGBA8_UI(
+                static_cast<uint8_t>(color.r),
+                static_cast<uint8_t>(color.g),
+                static_cast<uint8_t>(color.b),
+                255);
+        }
+    });
+}
\ No newline at end of file
@@ -0,0 +1,19 @@
+#ifndef __IMAGE_CONVERSION__
+#define __IMAGE_CONVERSION__
+#include "CPU-Ray-Tracing/CPURayTracer.hpp"
+#include "WEngine.h"
+#include <functional>
+
+namespace ImageConversion {
+
+/// @brief Splits the rows in equally sized ranges and processes them concurrently.
+/// Small images, such as interactive previews, are processed on the calling thread
+void parallel_rows(uint32_t width, uint32_t height, const std::function<void(uint32_t, uint32_t)>& fn);
+
+/// @brief Clamps and converts float colors to RGBA8. Row major and multithreaded
+/// @param rgba Output buffer, of width * height elements
+void to_rgba8(const RT::RGBColor* pixels, uint32_t width, uint32_t height, Wolf::RGBA8_UI* rgba);
+
+}
+
+#endif
\ No newline at end of file
@@ -3,6 +3,7 @@
 #include "ImGuiUtils.hpp"
 #include <imgui/imgui.h>
 
+#include <algorithm>
 #include <array>
 #include <chrono>
 #include <ctime>
@@ -13,6 +14,9 @@ using namespace RT;
 
 static constexpr const char* s_imgui_init_relative_path = "../imgui.ini";
 
+// Encoded sequence frames that can be pending, each one holds a copy of the buffer
+static constexpr size_t s_max_pending_sequence_frames = 4;
+
 void MainLayer::on_start()
 {
     auto& window = Application::get()->get_main_window();
@@ -62,7 +66,8 @@ void MainLayer::on_event(const Unique<Event>& event)
     dispatcher.dispatch<ButtonDownEvent>(
         Wolf::EventType::ButtonDown,
         [&](const Unique<ButtonDownEvent>& event) {
-            if (event->button == MouseButton::RIGHT)
+            // Editor camera is locked while rendering a sequence
+            if (event->button == MouseButton::RIGHT && !sequence_renderer.is_running())
                 camera_enabled = render_panel.is_hovered();
             return false;
         });
@@ -71,8 +76,9 @@ void MainLayer::on_event(const Unique<Event>& event)
         Wolf::EventType::ButtonUp,
         [&](const Unique<ButtonUpEvent>& event) {
             // Camera not used anymore, renders with
-            // high quality
-            if (event->button == MouseButton::RIGHT) {
+            // high quality. Skipped while rendering a sequence, since the
+            // frame wouldn't be saved
+            if (event->button == MouseButton::RIGHT && !sequence_renderer.is_running()) {
                 camera_enabled = false;
                 _render();
             }
@@ -83,6 +89,8 @@ void MainLayer::on_event(const Unique<Event>& event)
 
 void MainLayer::on_update(const Wolf::Time& delta)
 {
+    render_exporter.poll();
+
     if (render_panel.is_hovered()) {
         auto& io = ImGui::GetIO();
         ImGui::CaptureMouseFromApp(false);
@@ -104,6 +112,12 @@ void MainLayer::on_update(const Wolf::Time& delta)
         mouse_pos = current_mouse_pos;
     }
 
+    // Editor camera is locked while rendering a sequence
+    if (sequence_renderer.is_running()) {
+        _render_sequence_frame();
+        return;
+    }
+
     if (camera_enabled && camera_controller.on_update(mouse_delta, delta)) {
         world.camera->set_eye(camera_controller.get_eye());
         world.camera->set_look_at(camera_controller.get_look_at());
@@ -137,8 +151,17 @@ void MainLayer::on_ui_render_start()
                 if (ImGui::MenuItem("Save imgui layout", NULL, false, true)) {
                     ImGui::SaveIniSettingsToDisk(s_imgui_init_relative_path);
                 }
-                if (ImGui::MenuItem("Save render", NULL, false, true)) {
-                    _save_render();
+                if (ImGui::BeginMenu("Save render")) {
+                    if (ImGui::MenuItem("PNG"))
+                        _save_render(ExportFormat::PNG);
+
+                    if (ImGui::MenuItem("Radiance HDR"))
+                        _save_render(ExportFormat::HDR);
+
+                    if (ImGui::MenuItem("PFM - 32 bit float"))
+                        _save_render(ExportFormat::PFM);
+
+                    ImGui::EndMenu();
                 }
                 ImGui::EndMenu();
             }
@@ -215,6 +238,40 @@ void MainLayer::on_ui_render_start()
         ImGui::SameLine();
         render_time += std::to_string(render_panel.get_render_time());
         ImGui::Text("%s", render_time.c_str());
+        ImGui::Separator();
+
+        if (ImGui::TreeNodeEx("Turntable sequence", ImGuiTreeNodeFlags_Framed)) {
+            int frames_per_turn = sequence_renderer.frames_per_turn;
+            int frame_range[2] = {
+                static_cast<int>(sequence_renderer.start_frame),
+                static_cast<int>(sequence_renderer.end_frame)
+            };
+
+            if (ImGui::InputInt("Frames per turn", &frames_per_turn))
+                sequence_renderer.frames_per_turn = std::max(frames_per_turn, 1);
+
+            if (ImGui::InputInt2("Frame range", frame_range)) {
+                sequence_renderer.start_frame = std::max(frame_range[0], 0);
+                sequence_renderer.end_frame = std::max(frame_range[1], static_cast<int>(sequence_renderer.start_frame));
+            }
+
+            int format = static_cast<int>(sequence_renderer.format);
+            if (ImGuiUtils::combo_box<3>("Format", { "PNG", "Radiance HDR", "PFM - 32 bit float" }, format))
+                sequence_renderer.format = static_cast<ExportFormat>(format);
+
+            if (!sequence_renderer.is_running()) {
+                if (ImGui::Button("Render sequence"))
+                    sequence_renderer.start(world.camera);
+            } else {
+                if (ImGui::Button("Stop")) {
+                    sequence_renderer.stop(world.camera);
+                    _render();
+                }
+                ImGui::SameLine();
+                ImGui::Text("Frame %u / %u", sequence_renderer.get_current_frame(), sequence_renderer.end_frame);
+            }
+            ImGui::TreePop();
+        }
 
         ImGui::End();
     }
@@ -383,10 +440,15 @@ void MainLayer::_render()
     else
         settings = render_settings;
 
+    // Rebuilds, once, the bounding boxes modified since the last render
+    Editor::SceneNodePtr& scene_root = scene_hierarchy_panel.get_root_container();
+    if (scene_root != nullptr)
+        Editor::SceneNode::rebuild_modified(scene_root);
+
     render_panel.render_scene(world, settings);
 }
 
-void MainLayer::_save_render()
+void MainLayer::_save_render(ExportFormat format)
 {
     // Gets system date and time
     std::string relative_save_folder = "./../renders/screenshots/";
@@ -396,30 +458,29 @@ void MainLayer::_save_render()
         struct tm tstruct;
         char buf[80];
         tstruct = *localtime(&now);
-        strftime(buf, sizeof(buf), "%Y-%m-%d", &tstruct);
+        strftime(buf, sizeof(buf), "%Y-%m-%d-%H_%M_%S", &tstruct);
 
         image_name += buf;
     }
-    image_name += ".png";
-    std::cout << "Saved image at: " << image_name << std::endl;
-
-    // Creates temporary RGBA_8 buffer
-    auto buffer = std::make_shared<Wolf::Rendering::BitMap<Wolf::RGBA8_UI>>(
-        world.render_buffer->width,
-        world.render_buffer->height);
-
-    // Fills new buffer
-    for (uint32_t x = 0; x < buffer->width; x++) {
-        for (uint32_t y = 0; y < buffer->height; y++) {
-            auto rendered_color = world.render_buffer->get_pixel(x, y);
-            rendered_color = glm::clamp(rendered_color, RT::RGBColor(0), RT::RGBColor(1));
-            RGBA8_UI color(
-                static_cast<uint8_t>(rendered_color.r * 255),
-                static_cast<uint8_t>(rendered_color.g * 255),
-                static_cast<uint8_t>(rendered_color.b * 255),
-                255);
-            buffer->set_pixel({ x, y }, color);
-        }
+
+    // Conversion and encoding run in a background job
+    render_exporter.save(world, image_name, format);
+}
+
+void MainLayer::_render_sequence_frame()
+{
+    if (!sequence_renderer.setup_frame(world.camera)) {
+        sequence_renderer.stop(world.camera);
+        _render();
+        return;
     }
-    Wolf::Assets::save_bitmap_png(image_name, buffer);
+
+    // Sequence frames always use the final render settings
+    camera_enabled = false;
+    _render();
+
+    // Encoding runs in background while the next frame is traced
+    render_exporter.save(world, sequence_renderer.get_frame_path(), sequence_renderer.format);
+    render_exporter.wait_pending(s_max_pending_sequence_frames);
+    sequence_renderer.advance();
 }
\ No newline at end of file
@@ -1,6 +1,8 @@
 #include "CPU-Ray-Tracing/CPURayTracer.hpp"
 #include "CameraController.hpp"
+#include "RenderExporter.hpp"
 #include "RenderSettings.hpp"
+#include "SequenceRenderer.hpp"
 #include "WEngine.h"
 #include "editor/EditorUI.hpp"
 #include "editor/InspectorPanel.hpp"
@@ -18,6 +20,8 @@ public:
     Editor::InspectorPanel inspector_panel;
     Editor::EditorUI editor_ui;
     Editor::RenderPanel render_panel;
+    RenderExporter render_exporter;
+    SequenceRenderer sequence_renderer;
 
     RenderSettings::Settings render_settings;
     RenderSettings::Settings camera_render_settings;
@@ -35,5 +39,8 @@ private:
 
     /// @brief Renders scene to main viewport
     void _render();
-    void _save_render();
+    void _save_render(ExportFormat format);
+
+    /// @brief Renders the current sequence frame and saves it in background
+    void _render_sequence_frame();
 };
\ No newline at end of file
@@ -0,0 +1,187 @@
+#include "RenderExporter.hpp"
+#include "ImageConversion.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+
+using namespace RT;
+
+/// @brief Writers return false when the file couldn't be fully written
+static bool save_png(const std::string& path, uint32_t width, uint32_t height, const std::vector<RGBColor>& pixels)
+{
+    // The PNG writer doesn't report errors, so the folder is checked before
+    // writing and the file after. A previous file at the same path is removed
+    // first, otherwise a failed overwrite would look like a successful save
+    std::filesystem::path folder = std::filesystem::path(path).parent_path();
+    if (!folder.empty() && !std::filesystem::is_directory(folder))
+        return false;
+
+    std::error_code error;
+    std::filesystem::remove(path, error);
+    if (error)
+        return false;
+
+    auto bitmap = std::make_shared<Wolf::Rendering::BitMap<Wolf::RGBA8_UI>>(width, height);
+    ImageConversion::to_rgba8(
+        pixels.data(),
+        width,
+        height,
+        reinterpret_cast<Wolf::RGBA8_UI*>(bitmap->buffer_raw_ptr()));
+    Wolf::Assets::save_bitmap_png(path, bitmap);
+    return std::filesystem::exists(path, error) && std::filesystem::file_size(path, error) > 0 && !error;
+}
+
+/// @brief Radiance RGBE, with run length encoded scanlines made of literal dumps only
+static bool save_hdr(const std::string& path, uint32_t width, uint32_t height, const std::vector<RGBColor>& pixels)
+{
+    // Each scanline stores the 4 RGBE channels one after the other
+    std::vector<uint8_t> channels(pixels.size() * 4);
+
+    ImageConversion::parallel_rows(width, height, [&](uint32_t row_begin, uint32_t row_end) {
+        for (uint32_t y = row_begin; y < row_end; y++) {
+            uint8_t* scanline = channels.data() + static_cast<size_t>(y) * width * 4;
+            for (uint32_t x = 0; x < width; x++) {
+                const RGBColor& color = pixels[static_cast<size_t>(y) * width + x];
+                float v = std::max(color.r, std::max(color.g, color.b));
+                uint8_t rgbe[4] = { 0, 0, 0, 0 };
+                if (v > 1e-32f) {
+                    int exponent;
+                    float scale = std::frexp(v, &exponent) * 256.0f / v;
+                    rgbe[0] = static_cast<uint8_t>(std::max(0.0f, color.r) * scale);
+                    rgbe[1] = static_cast<uint8_t>(std::max(0.0f, color.g) * scale);
+                    rgbe[2] = static_cast<uint8_t>(std::max(0.0f, color.b) * scale);
+                    rgbe[3] = static_cast<uint8_t>(exponent + 128);
+                }
+                for (int c = 0; c < 4; c++)
+                    scanline[c * width + x] = rgbe[c];
+            }
+        }
+    });
+
+    std::ofstream file(path, std::ios::binary);
+    if (!file.is_open())
+        return false;
+
+    file << "#?RADIANCE\nFORMAT=32-bit_rle_rgbe\n\n";
+    file << "-Y " << height << " +X " << width << "\n";
+
+    // Render buffer rows are stored bottom-up, Radiance files top-down
+    for (uint32_t row = 0; row < height; row++) {
+        uint32_t y = height - 1 - row;
+        const uint8_t* scanline = channels.data() + static_cast<size_t>(y) * width * 4;
+
+        // Run length encoding is only defined for widths in [8, 32767]
+        if (width < 8 || width > 0x7FFF) {
+            for (uint32_t x = 0; x < width; x++) {
+                for (int c = 0; c < 4; c++)
+                    file.put(static_cast<char>(scanline[c * width + x]));
+            }
+            continue;
+        }
+
+        uint8_t header[4] = { 2, 2, static_cast<uint8_t>(width >> 8), static_cast<uint8_t>(width & 0xFF) };
+        file.write(reinterpret_cast<const char*>(header), 4);
+
+        for (int c = 0; c < 4; c++) {
+            const uint8_t* channel = scanline + c * width;
+            for (uint32_t x = 0; x < width; x += 128) {
+                uint8_t count = static_cast<uint8_t>(std::min(128u, width - x));
+                file.put(static_cast<char>(count));
+                file.write(reinterpret_cast<const char*>(channel + x), count);
+            }
+        }
+    }
+    file.flush();
+    return file.good();
+}
+
+/// @brief Portable float map, lossless 32 bit float RGB
+static bool save_pfm(const std::string& path, uint32_t width, uint32_t height, const std::vector<RGBColor>& pixels)
+{
+    std::ofstream file(path, std::ios::binary);
+    if (!file.is_open())
+        return false;
+
+    // Negative scale means little endian. Rows are stored bottom-up,
+    // the same as the render buffer
+    file << "PF\n"
+         << width << " " << height << "\n-1.0\n";
+
+    for (const RGBColor& color : pixels) {
+        float rgb[3] = { color.r, color.g, color.b };
+        file.write(reinterpret_cast<const char*>(rgb), sizeof(rgb));
+    }
+    file.flush();
+    return file.good();
+}
+
+RenderExporter::~RenderExporter()
+{
+    for (auto& job : _jobs)
+        job.wait();
+}
+
+void RenderExporter::save(const RT::World& world, const std::string& path, ExportFormat format)
+{
+    uint32_t width = world.render_buffer->width;
+    uint32_t height = world.render_buffer->height;
+
+    // Copies the buffer, so the next render can start while saving
+    std::vector<RGBColor> pixels(static_cast<size_t>(width) * height);
+    std::memcpy(pixels.data(), world.render_buffer->buffer_raw_ptr(), pixels.size() * sizeof(RGBColor));
+
+    std::string file_path = path + get_extension(format);
+
+    _jobs.push_back(std::async(std::launch::async, [=, pixels = std::move(pixels)]() {
+        bool saved = false;
+        switch (format) {
+        case ExportFormat::PNG:
+            saved = save_png(file_path, width, height, pixels);
+            break;
+        case ExportFormat::HDR:
+            saved = save_hdr(file_path, width, height, pixels);
+            break;
+        case ExportFormat::PFM:
+            saved = save_pfm(file_path, width, height, pixels);
+            break;
+        }
+
+        if (saved)
+            std::cout << "Saved image at: " << file_path << std::endl;
+        else
+            std::cout << "Unable to save image at: " << file_path << std::endl;
+    }));
+}
+
+void RenderExporter::poll()
+{
+    auto finished = [](std::future<void>& job) {
+        return job.wait_for(std::chrono::seconds(0)) == std::future_status::ready;
+    };
+    _jobs.erase(std::remove_if(_jobs.begin(), _jobs.end(), finished), _jobs.end());
+}
+
+void RenderExporter::wait_pending(size_t max_jobs)
+{
+    poll();
+    while (!_jobs.empty() && _jobs.size() >= max_jobs) {
+        _jobs.front().wait();
+        poll();
+    }
+}
+
+const char* RenderExporter::get_extension(ExportFormat format)
+{
+    switch (format) {
+    case ExportFormat::HDR:
+        return ".hdr";
+    case ExportFormat::PFM:
+        return ".pfm";
+    default:
+        return ".png";
+    }
+}
\ No newline at end of file
@@ -0,0 +1,39 @@
+#ifndef __RENDER_EXPORTER__
+#define __RENDER_EXPORTER__
+#include "CPU-Ray-Tracing/CPURayTracer.hpp"
+#include <future>
+#include <string>
+#include <vector>
+
+enum class ExportFormat {
+    PNG,
+    HDR,
+    PFM
+};
+
+/// @brief Saves renders to disk in background jobs, so the UI
+/// thread doesn't wait for the conversion and encoding
+class RenderExporter {
+public:
+    RenderExporter() = default;
+    ~RenderExporter();
+
+    /// @brief Copies the render buffer and saves it in a background job
+    /// @param path File path without extension, it's added from the format
+    void save(const RT::World& world, const std::string& path, ExportFormat format);
+
+    /// @brief Removes finished jobs
+    void poll();
+
+    /// @brief Blocks until less than 'max_jobs' jobs are pending, bounding
+    /// the memory used by the copied buffers
+    void wait_pending(size_t max_jobs);
+
+    /// @brief File extension of the format, including the dot
+    static const char* get_extension(ExportFormat format);
+
+private:
+    std::vector<std::future<void>> _jobs;
+};
+
+#endif
\ No newline at end of file
@@ -1,4 +1,5 @@
 #include "RenderSettings.hpp"
+#include "SamplerCache.hpp"
 
 using namespace RT;
 using namespace RenderSettings;
@@ -17,27 +18,20 @@ Settings RenderSettings::read_settings(const RT::World& world)
 void RenderSettings::load_settings(RT::World& world, const Settings& settings)
 {
 
-    // Sampler setup
+    // Sampler setup, reuses the cached sample sets. The current sampler is
+    // kept when neither the type nor the sample count changed. The sampler is
+    // assigned directly, the same way the sampler editor does, since
+    // 'set_sampler' would generate the sets again
     {
-        std::shared_ptr<Sampler> sampler;
-        switch (settings.sampler_type) {
-        case SamplerType::Regular:
-            sampler = std::make_shared<Samplers::RegularSampler>(settings.sample_count);
-            break;
-
-        case SamplerType::Jittered:
-            sampler = std::make_shared<Samplers::JitteredSampler>(settings.sample_count);
-            break;
-
-        case SamplerType::MultiJittered:
-            sampler = std::make_shared<Samplers::MultiJitteredSampler>(settings.sample_count);
-            break;
-
-        case SamplerType::NRooks:
-            sampler = std::make_shared<Samplers::NRooksSampler>(settings.sample_count);
+        std::shared_ptr<Sampler>& current = world.view_plane.sampler;
+        if (current->get_type() != settings.sampler_type
+            || current->get_num_samples() != settings.sample_count) {
+            current = SamplerCache::get(
+                settings.sampler_type,
+                settings.sample_count,
+                current->get_mode());
+            world.view_plane.samples = current->get_num_samples();
         }
-
-        world.view_plane.set_sampler(sampler);
     }
 
     // Viewport and pixel size
@@ -0,0 +1,81 @@
+#include "SamplerCache.hpp"
+#include <map>
+#include <mutex>
+#include <tuple>
+
+using namespace RT;
+
+typedef std::tuple<SamplerType, uint32_t, SampleMode> SamplerKey;
+
+// Prototypes are only copied, never used for sampling
+static std::map<SamplerKey, std::shared_ptr<Sampler>> s_prototypes;
+static std::mutex s_mutex;
+
+// Cache is cleared when it grows above this size
+static constexpr size_t s_max_cached_samplers = 64;
+
+static std::shared_ptr<Sampler> create_sampler(SamplerType type, uint32_t samples, SampleMode mode)
+{
+    std::shared_ptr<Sampler> sampler;
+    switch (type) {
+    case SamplerType::Regular:
+        sampler = std::make_shared<Samplers::RegularSampler>(samples);
+        break;
+
+    case SamplerType::Jittered:
+        sampler = std::make_shared<Samplers::JitteredSampler>(samples);
+        break;
+
+    case SamplerType::MultiJittered:
+        sampler = std::make_shared<Samplers::MultiJitteredSampler>(samples);
+        break;
+
+    case SamplerType::NRooks:
+        sampler = std::make_shared<Samplers::NRooksSampler>(samples);
+    }
+
+    sampler->generate_samples();
+    sampler->setup_shuffled_indices();
+
+    if (mode == SampleMode::Disk)
+        sampler->map_samples_to_unit_disk();
+
+    else if (mode == SampleMode::Hemisphere)
+        sampler->map_samples_to_hemisphere(1);
+
+    return sampler;
+}
+
+static std::shared_ptr<Sampler> copy_sampler(const std::shared_ptr<Sampler>& prototype)
+{
+    switch (prototype->get_type()) {
+    case SamplerType::Regular:
+        return std::make_shared<Samplers::RegularSampler>(*std::static_pointer_cast<Samplers::RegularSampler>(prototype));
+
+    case SamplerType::Jittered:
+        return std::make_shared<Samplers::JitteredSampler>(*std::static_pointer_cast<Samplers::JitteredSampler>(prototype));
+
+    case SamplerType::MultiJittered:
+        return std::make_shared<Samplers::MultiJitteredSampler>(*std::static_pointer_cast<Samplers::MultiJitteredSampler>(prototype));
+
+    case SamplerType::NRooks:
+        return std::make_shared<Samplers::NRooksSampler>(*std::static_pointer_cast<Samplers::NRooksSampler>(prototype));
+    }
+    return nullptr;
+}
+
+std::shared_ptr<Sampler> SamplerCache::get(SamplerType type, uint32_t samples, SampleMode mode)
+{
+    std::lock_guard<std::mutex> lock(s_mutex);
+
+    SamplerKey key { type, samples, mode };
+    auto itr = s_prototypes.find(key);
+    if (itr == s_prototypes.end()) {
+        if (s_prototypes.size() >= s_max_cached_samplers)
+            s_prototypes.clear();
+
+        itr = s_prototypes.emplace(key, create_sampler(type, samples, mode)).first;
+    }
+
+    return copy_sampler(itr->second);
+}
\ No newline at end of file
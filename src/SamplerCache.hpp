@@ -0,0 +1,16 @@
+#ifndef __SAMPLER_CACHE__
+#define __SAMPLER_CACHE__
+#include <CPU-Ray-Tracing/CPURayTracer.hpp>
+#include <memory>
+
+namespace SamplerCache {
+
+/// @brief Returns a new sampler with it's sample sets already generated,
+/// shuffled and mapped to 'mode'. Sample sets are generated once per
+/// (type, samples, mode) and copied into each returned sampler, so callers
+/// own their sampler and it's counters
+std::shared_ptr<RT::Sampler> get(RT::SamplerType type, uint32_t samples, RT::SampleMode mode);
+
+}
+
+#endif
\ No newline at end of file
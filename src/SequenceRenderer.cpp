@@ -0,0 +1,53 @@
+#include "SequenceRenderer.hpp"
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <filesystem>
+
+void SequenceRenderer::start(const std::shared_ptr<Camera>& camera)
+{
+    _eye = camera->eye;
+    _look_at = camera->look_at;
+    _current_frame = start_frame;
+    _running = true;
+    std::filesystem::create_directories(output_folder);
+}
+
+void SequenceRenderer::stop(const std::shared_ptr<Camera>& camera)
+{
+    if (!_running)
+        return;
+
+    camera->set_eye(_eye);
+    camera->set_look_at(_look_at);
+    camera->setup_camera();
+    _running = false;
+}
+
+bool SequenceRenderer::setup_frame(const std::shared_ptr<Camera>& camera)
+{
+    if (_current_frame > end_frame)
+        return false;
+
+    // Rotates the eye offset around the vertical axis
+    float angle = Constants::PI_2 * _current_frame / std::max(frames_per_turn, 1u);
+    float cos_angle = cosf(angle);
+    float sin_angle = sinf(angle);
+    Vec3f offset = _eye - _look_at;
+    Vec3f rotated(
+        offset.x * cos_angle + offset.z * sin_angle,
+        offset.y,
+        -offset.x * sin_angle + offset.z * cos_angle);
+
+    camera->set_eye(_look_at + rotated);
+    camera->set_look_at(_look_at);
+    camera->setup_camera();
+    return true;
+}
+
+std::string SequenceRenderer::get_frame_path() const
+{
+    char frame_number[16];
+    snprintf(frame_number, sizeof(frame_number), "%04u", _current_frame);
+    return output_folder + "frame_" + frame_number;
+}
\ No newline at end of file
@@ -0,0 +1,56 @@
+#ifndef __SEQUENCE_RENDERER__
+#define __SEQUENCE_RENDERER__
+#include "CPU-Ray-Tracing/CPURayTracer.hpp"
+#include "RenderExporter.hpp"
+#include <string>
+
+using namespace RT;
+
+/// @brief Turntable sequence, orbits the camera eye around the look at point.
+/// Frames are rendered one per update, so the UI stays responsive
+class SequenceRenderer {
+public:
+    SequenceRenderer()
+        : frames_per_turn(120)
+        , start_frame(0)
+        , end_frame(119)
+        , format(ExportFormat::PNG)
+        , output_folder("./../renders/turntable/")
+        , _running(false)
+        , _current_frame(0)
+    {
+    }
+
+    /// @brief Stores the camera placement and starts at 'start_frame'
+    void start(const std::shared_ptr<Camera>& camera);
+
+    /// @brief Stops the sequence and restores the camera placement
+    void stop(const std::shared_ptr<Camera>& camera);
+
+    /// @brief Places the camera for the current frame
+    /// @return False when all the frames were rendered
+    bool setup_frame(const std::shared_ptr<Camera>& camera);
+
+    /// @brief Moves to the next frame
+    inline void advance() { _current_frame++; }
+
+    /// @brief Numbered file path of the current frame, without extension
+    std::string get_frame_path() const;
+
+    inline bool is_running() const { return _running; }
+    inline uint32_t get_current_frame() const { return _current_frame; }
+
+public:
+    uint32_t frames_per_turn;
+    uint32_t start_frame, end_frame;
+    ExportFormat format;
+    std::string output_folder;
+
+private:
+    bool _running;
+    uint32_t _current_frame;
+    Vec3f _eye;
+    Vec3f _look_at;
+};
+
+#endif
\ No newline at end of file
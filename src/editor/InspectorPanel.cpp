@@ -131,7 +131,7 @@ void Editor::InspectorPanel::_render_geometric_object_editor(SceneNodePtr& scene
             break;
 
         case GeometricObjectType::BoundingVolumeHierarchy:
-            edit_states = Editor::ObjectEditor::edit_bvh(_object);
+            edit_states = Editor::ObjectEditor::edit_bvh(_object, scene_node);
             break;
 
         case GeometricObjectType::Container:
@@ -230,10 +230,8 @@ void Editor::InspectorPanel::_render_geometric_object_editor(SceneNodePtr& scene
         ImGui::TreePop();
     }
 
-    if (edit_states & ObjectEditor::EditState::BoundingBoxEdit) {
-        scene_node->get_object()->recalculate_bounding_box();
+    if (edit_states & ObjectEditor::EditState::BoundingBoxEdit)
         SceneNode::bounding_box_modified(scene_node);
-    }
 
     if (edit_states & ObjectEditor::EditState::PropertyEdit) {
         // @todo re-render call
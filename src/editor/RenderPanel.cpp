@@ -1,4 +1,5 @@
 #include "RenderPanel.hpp"
+#include "../ImageConversion.hpp"
 #include <imgui/imgui.h>
 
 using namespace Wolf;
@@ -41,21 +42,30 @@ void Editor::RenderPanel::render_scene(World& world, const RenderSettings::Setti
         if (!render_success)
             return;
     }
-    // Texture configuration
+    // Texture configuration. The texture is stored as 8 bit per channel,
+    // so the buffer is packed before uploading instead of sending floats
     Rendering::TextureConfig texture_config;
-    texture_config.pixel_format = Rendering::TextureTypes::PixelFormat::RGB;
-    texture_config.internal_pixel_format = Rendering::TextureTypes::PixelInternalFormat::RGB_8;
-    texture_config.pixel_type = Rendering::TextureTypes::PixelType::FLOAT;
+    texture_config.pixel_format = Rendering::TextureTypes::PixelFormat::RGBA;
+    texture_config.internal_pixel_format = Rendering::TextureTypes::PixelInternalFormat::RGBA_8;
+    texture_config.pixel_type = Rendering::TextureTypes::PixelType::UNSIGNED_BYTE;
     texture_config.min_filter = texture_config.mag_filter = Rendering::TextureTypes::Filter::NEAREST;
 
     // Stores output buffer in bitmap
     _render_width = world.render_buffer->width;
     _render_height = world.render_buffer->height;
 
-    // Creates a bitmap and copies buffer
-    auto bitmap = std::make_shared<Rendering::BitMap<RGBColor>>(
+    // Converts the float buffer straight into the preview bitmap, which is
+    // only reallocated when the render size changes
+    if (!_preview_bitmap || _preview_bitmap->width != _render_width || _preview_bitmap->height != _render_height) {
+        _preview_bitmap = std::make_shared<Rendering::BitMap<RGBA8_UI>>(
+            _render_width,
+            _render_height);
+    }
+    ImageConversion::to_rgba8(
+        reinterpret_cast<const RGBColor*>(world.render_buffer->buffer_raw_ptr()),
         _render_width,
-        _render_height);
-    bitmap->copy_buffer(world.render_buffer->buffer_raw_ptr());
-    _texture = Rendering::Texture::from_bitmap(bitmap, texture_config);
+        _render_height,
+        reinterpret_cast<RGBA8_UI*>(_preview_bitmap->buffer_raw_ptr()));
+
+    _texture = Rendering::Texture::from_bitmap(_preview_bitmap, texture_config);
 }
\ No newline at end of file
@@ -34,6 +34,7 @@ private:
     double _render_time;
     std::shared_ptr<Wolf::Rendering::Texture> _texture;
     uint32_t _render_width, _render_height;
+    std::shared_ptr<Wolf::Rendering::BitMap<Wolf::RGBA8_UI>> _preview_bitmap;
 };
 
 }
@@ -39,15 +39,11 @@ void Editor::SceneHierarchyPanel::_render_node(SceneNodePtr& node, uint32_t id)
         if (payload) {
             SceneNodePtr object = *reinterpret_cast<SceneNodePtr*>(payload->Data);
 
-            if (object->get_parent() == node)
-                return;
-
-            // Changes parent
-            SceneNode::set_parent(node, object);
-
-            // Recalculates bounding box and propagates upwards
-            node->get_object()->recalculate_bounding_box();
-            SceneNode::bounding_box_modified(node);
+            // Changes parent. Both, previous and new parent, are marked as
+            // modified and rebuilt before the next render. Drops that would
+            // make an object, or an instance, contain itself are rejected
+            if (object->get_parent() != node && SceneNode::can_parent(node, object))
+                SceneNode::set_parent(node, object);
         }
         ImGui::EndDragDropTarget();
     }
@@ -191,7 +187,6 @@ void Editor::SceneHierarchyPanel::_popup_context_item(SceneNodePtr& node)
         if (new_object != nullptr) {
             auto material = std::make_shared<RT::Materials::Phong>();
             new_object->set_material(material);
-            new_object->recalculate_bounding_box();
 
             SceneNodePtr new_node = std::make_shared<SceneNode>(new_object);
             new_node->set_name(new_node_name);
@@ -201,6 +196,10 @@ void Editor::SceneHierarchyPanel::_popup_context_item(SceneNodePtr& node)
             set_selected(new_node);
         }
     }
+    if (!node->is_root() && ImGui::MenuItem("Create instance")) {
+        SceneNodePtr instance_node = SceneNode::create_instance(node);
+        set_selected(instance_node);
+    }
     if (ImGui::MenuItem("Remove")) {
         SceneNode::remove(node);
     }
@@ -22,6 +22,7 @@ public:
         _selected_object = _root_container;
     }
 
+    inline SceneNodePtr& get_root_container() { return _root_container; }
     inline SceneNodePtr get_selected() const { return _selected_object; }
     inline void set_selected(const SceneNodePtr& object) { _selected_object = object; }
     inline bool is_selected(const SceneNodePtr& object) const { return _selected_object.get() == object.get(); }
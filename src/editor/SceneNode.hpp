@@ -2,7 +2,10 @@
 #define __EDITOR_SCENE__
 #include "CPU-Ray-Tracing/CPURayTracer.hpp"
 #include <algorithm>
+#include <atomic>
+#include <future>
 #include <string>
+#include <thread>
 #include <vector>
 
 namespace Editor {
@@ -58,6 +61,21 @@ public:
         }
     }
 
+    /// @brief Checks that 'child' can be moved into 'parent' without making
+    /// an object contain itself. Nothing reachable from 'child', through it's
+    /// subtree and the sources of the instances in it, can be 'parent' or
+    /// one of it's ancestors. Sources are followed along the whole chain,
+    /// since they can contain instances too
+    static bool can_parent(const SceneNodePtr& parent, const SceneNodePtr& child)
+    {
+        std::vector<const SceneNode*> ancestors;
+        for (SceneNode* node = parent.get(); node != nullptr; node = node->_parent.get())
+            ancestors.push_back(node);
+
+        std::vector<const SceneNode*> visited;
+        return !_reaches_any(child, ancestors, visited);
+    }
+
     static void set_parent(SceneNodePtr& parent, SceneNodePtr& child)
     {
         // Unbinds previous parent
@@ -85,6 +103,8 @@ public:
         GeometricObjectPtr parent_object = previous_parent->get_object();
         std::shared_ptr<GeometricObjects::Container> previous_parent_container = std::dynamic_pointer_cast<GeometricObjects::Container>(parent_object);
         previous_parent_container->remove(node->get_object());
+
+        bounding_box_modified(previous_parent);
     }
 
     static void bind_parent(SceneNodePtr& parent, SceneNodePtr& node)
@@ -97,42 +117,175 @@ public:
         GeometricObjectPtr parent_object = parent->get_object();
         std::shared_ptr<GeometricObjects::Container> parent_container = std::dynamic_pointer_cast<GeometricObjects::Container>(parent_object);
         parent_container->add(node->get_object());
+
+        bounding_box_modified(parent);
     }
 
     static void remove(SceneNodePtr& node)
     {
+        // Previous parent is marked as modified when unbinding
         unbind_parent(node);
+    }
 
-        // Gets parent
+    /// @brief Creates an Instance node that references the object of 'node',
+    /// so the geometry and it's BVH are stored once and shared. The instance
+    /// is added next to 'node', in the same parent container
+    static SceneNodePtr create_instance(SceneNodePtr& node)
+    {
         SceneNodePtr parent = node->get_parent();
 
-        // If it has parent
-        if (parent) {
+        auto instance = std::make_shared<Instance>(node->get_object());
 
-            // Recalculates bounding boxes
-            parent->get_object()->recalculate_bounding_box();
-            SceneNode::bounding_box_modified(parent);
-        }
+        SceneNodePtr instance_node = std::make_shared<SceneNode>(instance);
+        instance_node->set_name(node->get_name() + " instance");
+        instance_node->_source = node;
+        node->_instances.push_back(instance_node);
+
+        bind_parent(parent, instance_node);
+        bounding_box_modified(instance_node);
+        return instance_node;
     }
 
-    /// @brief Called when the bounding box of a GeometricObject is modified
-    /// propagates this call upwards in 'bottom->up' way.
+    /// @brief Called when the bounding box of a GeometricObject is modified.
+    /// Marks the node, it's instances and all the ancestors as modified in
+    /// 'bottom->up' way. Bounding boxes are recalculated lazily, once, by
+    /// 'rebuild_modified' before rendering
     static void bounding_box_modified(SceneNodePtr& node)
     {
-        if (node == nullptr || node->is_root())
+        if (node == nullptr)
+            return;
+
+        // Ancestors of a modified node are already marked, only their
+        // revisions are bumped so cached editor data is refreshed
+        if (node->_modified) {
+            for (SceneNode* ancestor = node.get(); ancestor != nullptr; ancestor = ancestor->_parent.get())
+                ancestor->_revision++;
             return;
+        }
+
+        node->_modified = true;
+        node->_revision++;
+
+        // Instances transform the bounding box of the shared object,
+        // so all of them must be refitted
+        for (auto& weak_instance : node->_instances) {
+            SceneNodePtr instance = weak_instance.lock();
+            bounding_box_modified(instance);
+        }
 
         SceneNodePtr parent = node->get_parent();
-        GeometricObjectPtr parent_container = parent->get_object();
-        parent_container->recalculate_bounding_box();
         bounding_box_modified(parent);
     }
 
+    /// @brief Recalculates the bounding boxes of the modified nodes in
+    /// 'bottom->up' way. Modified children of 'node' are rebuilt concurrently
+    /// by a bounded number of worker threads, deeper levels run sequentially
+    static void rebuild_modified(SceneNodePtr& node)
+    {
+        if (node == nullptr || !node->_modified)
+            return;
+
+        // Shared objects must be rebuilt before their instances are refitted.
+        // They can live in any subtree, so they are rebuilt up front instead
+        // of from the worker threads
+        std::vector<SceneNodePtr> sources;
+        _collect_modified_sources(node, sources);
+        for (SceneNodePtr& source : sources)
+            _rebuild_sequential(source);
+
+        std::vector<SceneNodePtr> modified_children;
+        for (SceneNodePtr& child : node->_children) {
+            if (child->_modified)
+                modified_children.push_back(child);
+        }
+
+        uint32_t worker_count = std::min<uint32_t>(std::max(std::thread::hardware_concurrency(), 1U), modified_children.size());
+        std::atomic<uint32_t> next_child { 0 };
+        auto worker = [&]() {
+            for (uint32_t i = next_child++; i < modified_children.size(); i = next_child++)
+                _rebuild_sequential(modified_children[i]);
+        };
+
+        std::vector<std::future<void>> tasks;
+        for (uint32_t i = 1; i < worker_count; i++)
+            tasks.push_back(std::async(std::launch::async, worker));
+
+        // Calling thread also takes work
+        worker();
+
+        for (auto& task : tasks)
+            task.get();
+
+        node->get_object()->recalculate_bounding_box();
+        node->_modified = false;
+    }
+
+    inline bool is_modified() const { return _modified; }
+
+    /// @brief Incremented each time the node, or one of it's descendants, is
+    /// modified. Lets editors detect that cached data about the node is outdated
+    inline uint32_t get_revision() const { return _revision; }
+
+private:
+    static void _collect_modified_sources(const SceneNodePtr& node, std::vector<SceneNodePtr>& sources)
+    {
+        SceneNodePtr source = node->_source.lock();
+        if (source != nullptr && source->_modified)
+            sources.push_back(source);
+
+        for (const SceneNodePtr& child : node->_children) {
+            if (child->_modified)
+                _collect_modified_sources(child, sources);
+        }
+    }
+
+    static void _rebuild_sequential(const SceneNodePtr& node)
+    {
+        if (!node->_modified)
+            return;
+
+        SceneNodePtr source = node->_source.lock();
+        if (source != nullptr)
+            _rebuild_sequential(source);
+
+        for (const SceneNodePtr& child : node->_children) {
+            if (child->_modified)
+                _rebuild_sequential(child);
+        }
+
+        node->get_object()->recalculate_bounding_box();
+        node->_modified = false;
+    }
+
+    static bool _reaches_any(const SceneNodePtr& node, const std::vector<const SceneNode*>& targets, std::vector<const SceneNode*>& visited)
+    {
+        if (std::find(visited.begin(), visited.end(), node.get()) != visited.end())
+            return false;
+        visited.push_back(node.get());
+
+        if (std::find(targets.begin(), targets.end(), node.get()) != targets.end())
+            return true;
+
+        SceneNodePtr source = node->_source.lock();
+        if (source != nullptr && _reaches_any(source, targets, visited))
+            return true;
+
+        for (const SceneNodePtr& child : node->_children) {
+            if (_reaches_any(child, targets, visited))
+                return true;
+        }
+        return false;
+    }
+
 private:
     std::string _name;
     GeometricObjectPtr _object;
     SceneNodePtr _parent;
     std::vector<SceneNodePtr> _children;
+    std::vector<std::weak_ptr<SceneNode>> _instances;
+    std::weak_ptr<SceneNode> _source;
+    std::atomic<bool> _modified { false };
+    uint32_t _revision = 0;
     const bool _is_container;
 };
 